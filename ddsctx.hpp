@@ -99,6 +99,13 @@ extern int ddsctx_get_valid(const int);
 #include <utility>
 #include <stdexcept>
 
+#if !defined(DDSCTX_NO_TRACE) && __has_include(<sys/sdt.h>)
+    #include <sys/sdt.h>
+    #define __DDSCTX_TRACE(N, PROBE, ...) DTRACE_PROBE##N(ddsctx, PROBE, __VA_ARGS__)
+#else
+    #define __DDSCTX_TRACE(N, PROBE, ...)
+#endif
+
 class DDSError: public std::runtime_error {
     
     dds_return_t _error;
@@ -124,6 +131,7 @@ class DDS final {
         void* _sample[1];
         dds_sample_info_t _info[1];
         const dds_topic_descriptor_t* _descriptor;
+        size_t _size;
         bool _alloced;
 
         void _alloced_check(void) {
@@ -138,6 +146,7 @@ class DDS final {
 
             void operator()(const size_t size, const dds_topic_descriptor_t* descriptor) {
                 _descriptor = descriptor;
+                _size = size;
                 _sample[0] = dds_alloc(size);
                 _alloced = true;
             }
@@ -152,6 +161,11 @@ class DDS final {
                 return _sample;
             }
 
+            size_t size(void) {
+                _alloced_check();
+                return _size;
+            }
+
             ~Sample(void) {
                 if(_sample[0])
                 dds_sample_free(_sample[0], _descriptor, DDS_FREE_ALL);
@@ -164,7 +178,7 @@ class DDS final {
     std::map<dds_domainid_t, dds_entity_t> _domain;
     std::map<
         std::pair<dds_domainid_t, std::string>,
-        std::tuple<dds_entity_t, dds_listener_t*, ddsctx_callback_t*>
+        std::tuple<dds_entity_t, dds_listener_t*, ddsctx_callback_t*, size_t>
     > _topic;
     std::map<
         std::pair<dds_domainid_t, std::string>,
@@ -242,7 +256,9 @@ class DDS final {
             DDSCTX_INSTANCE(dds);
 
             if(!dds._domain.count(domainid)) {
+                __DDSCTX_TRACE(1, domain_create_entry, domainid);
                 dds_entity_t participant = dds_create_participant(domainid, NULL, NULL);
+                __DDSCTX_TRACE(2, domain_create_return, domainid, participant);
                 if(participant < 0) throw DDSError("dds_create_participant", participant);
                 dds._domain[domainid] = participant;
             }
@@ -260,6 +276,7 @@ class DDS final {
             DDSCTX_INSTANCE(dds);
 
             if(!dds._topic.count({domainid, name})) {
+                __DDSCTX_TRACE(2, topic_create_entry, domainid, name.c_str());
                 dds_listener_t* listener = dds_create_listener(NULL);
                 dds_lset_inconsistent_topic(listener, _on_inconsistent_topic);
                 dds_entity_t topic = dds_create_topic(
@@ -269,8 +286,9 @@ class DDS final {
                     dds.qos(qos),
                     listener
                 );
+                __DDSCTX_TRACE(3, topic_create_return, domainid, name.c_str(), topic);
                 if(topic < 0) throw DDSError("dds_create_topic", topic);
-                dds._topic[{domainid, name}] = {topic, listener, nullptr};
+                dds._topic[{domainid, name}] = {topic, listener, nullptr, descriptor->m_size};
                 dds._entities[topic] = {domainid, name};
                 return topic;
             } else return std::get<0>(dds._topic[{domainid, name}]);
@@ -287,6 +305,7 @@ class DDS final {
 
             if(!dds._reader.count({domainid, topic})) {
                 if(!dds._topic.count({domainid, topic})) throw dds._unknow_topic(topic, domainid);
+                __DDSCTX_TRACE(2, reader_create_entry, domainid, topic.c_str());
                 dds_listener_t* listener = dds_create_listener(NULL);
                 dds_lset_data_available(listener, _on_data_available);
                 dds_lset_subscription_matched(listener, _on_subscription_matched);
@@ -295,13 +314,13 @@ class DDS final {
                 dds_lset_liveliness_changed(listener, _on_liveliness_changed);
                 dds_lset_requested_deadline_missed(listener, _on_requested_deadline_missed);
                 dds_lset_requested_incompatible_qos(listener, _on_requested_incompatible_qos);
-                auto& [topic_entity, topic_listener, callback] = dds._topic[{domainid, topic}];
                 dds_entity_t reader = dds_create_reader(
                     dds.domain(domainid),
-                    topic_entity,
+                    std::get<0>(dds._topic[{domainid, topic}]),
                     dds.qos(qos),
                     listener
                 );
+                __DDSCTX_TRACE(3, reader_create_return, domainid, topic.c_str(), reader);
                 if(reader < 0) throw DDSError("dds_create_reader", reader);
                 dds._reader[{domainid, topic}] = {reader, listener, nullptr};
                 dds._entities[reader] = {domainid, topic};
@@ -320,18 +339,19 @@ class DDS final {
 
             if(!dds._writer.count({domainid, topic})) {
                 if(!dds._topic.count({domainid, topic})) throw dds._unknow_topic(topic, domainid);
+                __DDSCTX_TRACE(2, writer_create_entry, domainid, topic.c_str());
                 dds_listener_t* listener = dds_create_listener(NULL);
                 dds_lset_publication_matched(listener, _on_publication_matched);
                 dds_lset_liveliness_lost(listener, _on_liveliness_lost);
                 dds_lset_offered_deadline_missed(listener, _on_offered_deadline_missed);
                 dds_lset_offered_incompatible_qos(listener, _on_offered_incompatible_qos);
-                auto& [topic_entity, topic_listener, callback] = dds._topic[{domainid, topic}];
                 dds_entity_t writer = dds_create_writer(
                     dds.domain(domainid),
-                    topic_entity,
+                    std::get<0>(dds._topic[{domainid, topic}]),
                     dds.qos(qos),
                     listener
                 );
+                __DDSCTX_TRACE(3, writer_create_return, domainid, topic.c_str(), writer);
                 if(writer < 0) throw DDSError("dds_create_writer", writer);
                 dds._writer[{domainid, topic}] = {writer, listener, nullptr};
                 dds._entities[writer] = {domainid, topic};
@@ -346,13 +366,20 @@ class DDS final {
             void* data
         ) {
 
+            __DDSCTX_TRACE(2, send_entry, domainid, topic.c_str());
+
             DDSCTX_INSTANCE(dds);
 
-            if(!dds._writer.count({domainid, topic})) throw dds._unknow_topic(topic, domainid);
+            if(!dds._writer.count({domainid, topic})) {
+                __DDSCTX_TRACE(4, send_return, domainid, topic.c_str(), size_t(0), -DDS_RETCODE_BAD_PARAMETER);
+                throw dds._unknow_topic(topic, domainid);
+            }
             dds_return_t write = dds_write(
                 std::get<0>(dds._writer[{domainid, topic}]),
                 data
             );
+            __DDSCTX_TRACE(4, send_return, domainid, topic.c_str(),
+                write < 0 ? 0 : std::get<3>(dds._topic[{domainid, topic}]), write);
             if(write < 0) throw DDSError("dds_write", write);
 
         }
@@ -363,10 +390,18 @@ class DDS final {
             const int sample
         ) {
 
+            __DDSCTX_TRACE(3, read_entry, domainid, topic.c_str(), sample);
+
             DDSCTX_INSTANCE(dds);
 
-            if(!dds._reader.count({domainid, topic})) throw dds._unknow_topic(topic, domainid);
-            if(!dds._sample.count(sample)) throw dds._unknow_sample(sample);
+            if(!dds._reader.count({domainid, topic})) {
+                __DDSCTX_TRACE(4, read_return, domainid, topic.c_str(), size_t(0), -DDS_RETCODE_BAD_PARAMETER);
+                throw dds._unknow_topic(topic, domainid);
+            }
+            if(!dds._sample.count(sample)) {
+                __DDSCTX_TRACE(4, read_return, domainid, topic.c_str(), size_t(0), -DDS_RETCODE_BAD_PARAMETER);
+                throw dds._unknow_sample(sample);
+            }
             Sample& sample_obj = dds._sample[sample];
             dds_return_t read = dds_read(
                 std::get<0>(dds._reader[{domainid, topic}]),
@@ -374,6 +409,7 @@ class DDS final {
                 sample_obj.info(),
                 1, 1
             );
+            __DDSCTX_TRACE(4, read_return, domainid, topic.c_str(), read > 0 ? read * sample_obj.size() : 0, read);
             if(read < 0) throw DDSError("dds_read", read);
 
         }
@@ -384,10 +420,18 @@ class DDS final {
             const int sample
         ) {
 
+            __DDSCTX_TRACE(3, take_entry, domainid, topic.c_str(), sample);
+
             DDSCTX_INSTANCE(dds);
 
-            if(!dds._reader.count({domainid, topic})) throw dds._unknow_topic(topic, domainid);
-            if(!dds._sample.count(sample)) throw dds._unknow_sample(sample);
+            if(!dds._reader.count({domainid, topic})) {
+                __DDSCTX_TRACE(4, take_return, domainid, topic.c_str(), size_t(0), -DDS_RETCODE_BAD_PARAMETER);
+                throw dds._unknow_topic(topic, domainid);
+            }
+            if(!dds._sample.count(sample)) {
+                __DDSCTX_TRACE(4, take_return, domainid, topic.c_str(), size_t(0), -DDS_RETCODE_BAD_PARAMETER);
+                throw dds._unknow_sample(sample);
+            }
             Sample& sample_obj = dds._sample[sample];
             dds_return_t take = dds_take(
                 std::get<0>(dds._reader[{domainid, topic}]),
@@ -395,7 +439,8 @@ class DDS final {
                 sample_obj.info(),
                 1, 1
             );
-            if(read < 0) throw DDSError("dds_take", take);
+            __DDSCTX_TRACE(4, take_return, domainid, topic.c_str(), take > 0 ? take * sample_obj.size() : 0, take);
+            if(take < 0) throw DDSError("dds_take", take);
 
         }
 
@@ -457,10 +502,16 @@ class DDS final {
         private:
 
 #define __DDSCTX_EVENT_CALLBACK(ENTITY, EVENT, DATA)\
+    __DDSCTX_TRACE(2, event_entry, ENTITY, EVENT);\
     DDSCTX_INSTANCE(dds);\
     auto& [domainid, topic_name] = dds._entities[ENTITY];\
     auto& callback = std::get<2>(dds._##ENTITY[{domainid, topic_name}]);\
-    if(callback) callback(EVENT, domainid, topic_name.c_str(), DATA);
+    if(callback) {\
+        __DDSCTX_TRACE(3, callback_entry, domainid, topic_name.c_str(), EVENT);\
+        callback(EVENT, domainid, topic_name.c_str(), DATA);\
+        __DDSCTX_TRACE(3, callback_return, domainid, topic_name.c_str(), EVENT);\
+    }\
+    __DDSCTX_TRACE(3, event_return, domainid, topic_name.c_str(), EVENT);
             static void _on_inconsistent_topic
             (dds_entity_t topic, const dds_inconsistent_topic_status_t status, void* arg)
             { __DDSCTX_EVENT_CALLBACK(topic, DDSCTX_TOPIC_ON_INCONSISTENT_TOPIC, &status) }